@@ -31,10 +31,25 @@
    #include <unistd.h>
    #include <time.h>
    #include <stdbool.h>
+   #include <pthread.h>
+   #include <limits.h>
+   #include <assert.h>
 //
 // Global Constant Definitions ////////////////////////////////////
 //
    #define BILLION   1E9 
+   #define PROCESS_ENTER     0
+   #define PROCESS_RUNNING   1
+   #define PROCESS_EXIT      2
+   #define ARENA_ALIGN       8
+   #define NUMBER_OF_DEVICES 5
+   #define SWEEP_MAX_VALUES  16
+   #define SWEEP_MAX_THREADS 8
+   #define COMPARE_THRESHOLD 10
+   #define COMPARE_FLOOR     5
+   #define TRACE_RUNS        3
+   #define TRACE_MAX_RUNS    100
+   #define TRACE_MISMATCH    2
 //
 // Class Definitions //////////////////////////////////////////////
 //
@@ -42,8 +57,10 @@
       {
        // struct that records meta data
        char component;
-       char operation[10];
+       char operation[11];
        int cyc_time;
+       int track;
+       int seekDistance;
       };
 
    struct pcb_table
@@ -56,6 +73,11 @@
        int keyboardCycleTime;
        char dataFile[15];
        char outputFile[15];
+       char diskPolicy[10];
+       int diskTracks;
+       int diskSeekTime;
+       int diskQueueDepth;
+       int diskSeed;
       };
 
    struct logLine
@@ -64,6 +86,63 @@
        double time;
        char comment[40];
       };
+
+   struct diskReport
+      {
+       // struct that records results of the disk scheduling
+       int numberOfRequests;
+       int totalSeek;
+       double averageResponse;
+      };
+
+   struct arena
+      {
+       // struct that records a bump allocator released in bulk,
+       // each block starts with a pointer to the block before it
+       char* base;
+       size_t size;
+       size_t used;
+      };
+
+   struct sweep_grid
+      {
+       // struct that records the cycle times to sweep for each device
+       int numberOfValues[NUMBER_OF_DEVICES];
+       int values[NUMBER_OF_DEVICES][SWEEP_MAX_VALUES];
+      };
+
+   struct sweep_batch
+      {
+       // struct that records a slice of configurations for one thread
+       int first;
+       int last;
+       double cycles[NUMBER_OF_DEVICES];
+       double seekTime;
+       double* cycleTime[NUMBER_OF_DEVICES];
+       double* busyTime[NUMBER_OF_DEVICES];
+       double* totalTime;
+      };
+
+   struct opTrace
+      {
+       // struct that records the decision and timing of one meta data
+       int metaIndex;
+       char component;
+       int track;
+       int seekDistance;
+       int queuedAfter;
+       double start;
+       double end;
+      };
+
+   struct process_table
+      {
+       // struct that records process states, one array per field
+       int numberOfProcess;
+       unsigned char* state;
+       int* remainingTime;
+       int* programCounter;
+      };
 //
 // Free Function Prototypes ///////////////////////////////////////
 //
@@ -75,73 +154,318 @@
    void delay( int time );
    void recordLog( struct logLine* currentLog, double time, char memo[40] );
    void printLog( struct logLine currentLog );
-   bool checkMeta( struct meta metaData, char comment[40] );
+   bool checkMeta( struct meta metaData, int processNumber, char comment[40] );
    bool checkLogEnd( char comment[40] );
    void outputToFile( struct logLine currentLog[], struct pcb_table pcb, 
                       int numberOfLog );
+   void diskSchedule( struct meta metaData[], int numberOfMeta, 
+                      struct pcb_table pcb, int runOrder[], int queuedAfter[], 
+                      struct diskReport* report );
+   void diskResponse( struct meta metaData[], int runOrder[], 
+                      int queuedAfter[], struct opTrace trace[], 
+                      int numberOfTrace, struct diskReport* report );
+   int selectRequest( struct meta metaData[], int queue[], int numberPending, 
+                      int head, int* direction, struct pcb_table pcb, 
+                      int* distance );
+   int nextTrack( unsigned int* seed, int numberOfTracks );
+   void printDiskReport( struct diskReport report, struct pcb_table pcb );
+   void countMeta( char* fileName, int* numberOfMeta, int* numberOfProcess );
+   void arenaInit( struct arena* pool, size_t size );
+   void arenaBlock( struct arena* pool, size_t size );
+   void* arenaAlloc( struct arena* pool, size_t size );
+   void arenaRelease( struct arena* pool );
+   void processInit( struct process_table* table, struct arena* pool, 
+                     struct meta metaData[], int runOrder[], int numberOfMeta, 
+                     int numberOfProcess, struct pcb_table pcb );
+   void processLoad( struct process_table* table, struct meta metaData[], 
+                     int runOrder[], int numberOfMeta, struct pcb_table pcb );
+   int findProcess( struct process_table* table, unsigned char state, 
+                    int from );
+   void readSweep( char* fileName, struct sweep_grid* grid, 
+                   struct pcb_table pcb );
+   void runSweep( struct meta metaData[], int numberOfMeta, 
+                  struct pcb_table pcb, struct diskReport report, 
+                  struct sweep_grid grid );
+   void* sweepWorker( void* batch );
+   int deviceOf( struct meta metaData );
+   void writeTrace( char* fileName, struct opTrace trace[], int numberOfTrace );
+   void readTrace( char* fileName, struct opTrace trace[], int numberOfTrace, 
+                   struct meta metaData[] );
+   void traceSchedule( struct opTrace trace[], int numberOfTrace, 
+                       struct meta metaData[], struct pcb_table pcb, 
+                       int runOrder[], int queuedAfter[], 
+                       struct diskReport* report );
+   void medianTrace( struct opTrace runTrace[], int numberOfRun, 
+                     int numberOfTrace, struct opTrace trace[], 
+                     struct arena* pool );
+   double median( double values[], int numberOfValues );
+   int compareTrace( struct opTrace baseline[], struct opTrace trace[], 
+                     int numberOfTrace, double threshold, double floorTime );
+   bool readNumber( char* text, double* value );
 //
 // Main Function Implementation ///////////////////////////////////
 //
    int main( int argc, char* argv[] )
       {
-       struct meta metaArray[40] = { 0, 0, 0 };   // meta data array
+       struct meta* metaArray;   // meta data array
        struct pcb_table myPCB = { 0, 0, 0, 0, 0, 0, 0 };   // pcb table
-       struct logLine myLog[100] = { 0, 0 };   // log array
+       struct logLine* myLog;   // log array
+       struct diskReport myDisk = { 0, 0, 0 };   // disk scheduling report
+       struct arena myArena = { 0, 0, 0 };   // arena for per-run storage
+       struct process_table myProcess = { 0 };   // process table
+       struct sweep_grid myGrid;   // cycle times to sweep
+       struct opTrace* myTrace;   // decisions and timings of this run
+       int* runOrder;   // meta data in the order they run
+       int* queuedAfter;   // op whose end queued each disk request
+       struct opTrace* baseTrace = NULL;   // recorded baseline to compare
+       bool isRecord = false;   // check if recording a trace
+       bool isReplay = false;   // check if replaying a trace
+       bool isCompare = false;   // check if comparing to a baseline
+       struct opTrace* runTrace;   // traces of every run
+       struct opTrace* medTrace = NULL;   // median trace of the runs
+       double threshold = COMPARE_THRESHOLD;   // regression threshold (%)
+       double floorTime = COMPARE_FLOOR;   // regression floor (msec)
+       double number = 0;   // number read from the command line
+       int numberOfRun = 1;   // number of runs
+       int run = 0;   // index to run
+       int numberOfRegression = 0;   // number of regressed ops
+       int numberOfMeta = 0;   // upper bound of meta data
+       int numberOfProcess = 0;   // number of processes
+       int processIndex = -1;   // index to running process
        bool isThread = false;   // check if the meta a thread
        bool logNeedEnd = false;   // check if the log needs a end log
        int numThreads = 0;   // number of threads
        struct timespec startTime, endTime;   // timer
        double totalTime;   // time range
        int metaIndex = 0;   // index to meta data
+       int runIndex = 0;   // index to run order
        int logIndex = 0;   // index to log
        char logComment[40];   // comment inside log
 
+       // check the command line
+       if( argc < 2 || argc == 3 
+           || ( argc > 3 && strcmp( argv[2], "-compare" ) != 0 
+                && ( argc > 4 || ( strcmp( argv[2], "-sweep" ) != 0 
+                                   && strcmp( argv[2], "-record" ) != 0 
+                                   && strcmp( argv[2], "-replay" ) != 0 ) ) ) 
+           || argc > 7 )
+          {
+           printf( "USAGE: Sim01 <config>\n" );
+           printf( "       Sim01 <config> -sweep <grid>\n" );
+           printf( "       Sim01 <config> -record <trace>\n" );
+           printf( "       Sim01 <config> -replay <trace>\n" );
+           printf( "       Sim01 <config> -compare <trace> [percent] "
+                   "[floor msec] [runs]\n" );
+           return 1;
+          }
+
+       // read the numbers after the trace file
+       if( argc > 3 && strcmp( argv[2], "-compare" ) == 0 )
+          {
+           numberOfRun = TRACE_RUNS;
+           if( argc > 4 && !readNumber( argv[4], &threshold ) )
+              {
+               printf( "INVALID THRESHOLD!\n" );
+               return 1;
+              }
+           if( argc > 5 && !readNumber( argv[5], &floorTime ) )
+              {
+               printf( "INVALID FLOOR!\n" );
+               return 1;
+              }
+          }
+       if( argc > 6 && strcmp( argv[2], "-compare" ) == 0 )
+          {
+           if( !readNumber( argv[argc - 1], &number ) || number < 1 
+               || number > TRACE_MAX_RUNS || number != ( int )number )
+              {
+               printf( "INVALID NUMBER OF RUNS!\n" );
+               return 1;
+              }
+           numberOfRun = number;
+          }
+
        // read config file
        readConfig( argv[1], &myPCB );
 
+       // size the meta data and allocate the per-run storage in bulk,
+       // the first block fits the meta data and the arena chains more
+       countMeta( myPCB.dataFile, &numberOfMeta, &numberOfProcess );
+       arenaInit( &myArena, ( size_t )numberOfMeta * ( sizeof( struct meta ) 
+                  + 2 * sizeof( struct logLine ) + 2 * sizeof( struct opTrace ) 
+                  + 2 * sizeof( int ) ) );
+       metaArray = arenaAlloc( &myArena, ( size_t )numberOfMeta 
+                                         * sizeof( struct meta ) );
+       myLog = arenaAlloc( &myArena, 2 * ( size_t )numberOfMeta 
+                                     * sizeof( struct logLine ) );
+       runTrace = arenaAlloc( &myArena, ( size_t )numberOfRun * numberOfMeta 
+                                        * sizeof( struct opTrace ) );
+       myTrace = runTrace;
+       medTrace = arenaAlloc( &myArena, ( size_t )numberOfMeta 
+                                        * sizeof( struct opTrace ) );
+       runOrder = arenaAlloc( &myArena, ( size_t )numberOfMeta * sizeof( int ) );
+       queuedAfter = arenaAlloc( &myArena, ( size_t )numberOfMeta * sizeof( int ) );
+
        // read meta data file
        dataInput( myPCB.dataFile, metaArray, &numThreads );
 
-       // start timer
-       clock_gettime( CLOCK_REALTIME, &startTime );
+       // pick the trace mode
+       if( argc > 3 && strcmp( argv[2], "-record" ) == 0 )
+          isRecord = true;
+       if( argc > 3 && strcmp( argv[2], "-replay" ) == 0 )
+          {
+           isReplay = true;
+           readTrace( argv[3], myTrace, numThreads, metaArray );
+          }
+       if( argc > 3 && strcmp( argv[2], "-compare" ) == 0 )
+          {
+           isCompare = true;
+           baseTrace = arenaAlloc( &myArena, ( size_t )numberOfMeta 
+                                             * sizeof( struct opTrace ) );
+           readTrace( argv[3], baseTrace, numThreads, metaArray );
+          }
 
-       // loop through the meta data array
-       for( metaIndex = 0; metaIndex < numThreads; metaIndex++ )
+       // schedule the hard drive requests, or take the recorded schedule
+       if( isReplay )
+          traceSchedule( myTrace, numThreads, metaArray, myPCB, runOrder, 
+                         queuedAfter, &myDisk );
+       else
+          diskSchedule( metaArray, numThreads, myPCB, runOrder, queuedAfter, 
+                        &myDisk );
+
+       // build the process table once the seeks are known
+       processInit( &myProcess, &myArena, metaArray, runOrder, numThreads, 
+                    numberOfProcess, myPCB );
+
+       // in sweep mode, evaluate the grid in virtual time and stop
+       if( argc > 3 && strcmp( argv[2], "-sweep" ) == 0 )
+          {
+           readSweep( argv[3], &myGrid, myPCB );
+           runSweep( metaArray, numThreads, myPCB, myDisk, myGrid );
+           arenaRelease( &myArena );
+           return 0;
+          }
+
+       // run the program, several times when taking a median
+       for( run = 0; run < numberOfRun; run ++ )
           {
-           // lap timer
-           clock_gettime( CLOCK_REALTIME, &endTime );
-           totalTime = timeLap( startTime, endTime );
+           if( !isReplay )
+              myTrace = runTrace + ( size_t )run * numThreads;
+           if( run > 0 )
+              processLoad( &myProcess, metaArray, runOrder, numThreads, myPCB );
+           processIndex = -1;
+           logIndex = 0;
+
+           // start timer
+           clock_gettime( CLOCK_REALTIME, &startTime );
 
-           // check if the meta is a thread
-           if( isThread = checkMeta( metaArray[metaIndex], logComment ) )
+           // loop through the meta data in the order they run
+           runIndex = 0;
+           while( runIndex < numThreads )
               {
-               // if it is, create a thread
-               thread_create( metaArray[metaIndex], myPCB );
-              }
+               metaIndex = runOrder[runIndex];
+
+               // lap timer, or take the recorded time when replaying
+               clock_gettime( CLOCK_REALTIME, &endTime );
+               totalTime = timeLap( startTime, endTime );
+               if( isReplay )
+                  totalTime = myTrace[runIndex].start;
+               myTrace[runIndex].metaIndex = metaIndex;
+               myTrace[runIndex].component = metaArray[metaIndex].component;
+               myTrace[runIndex].track = metaArray[metaIndex].track;
+               myTrace[runIndex].seekDistance = metaArray[metaIndex].seekDistance;
+               myTrace[runIndex].queuedAfter = queuedAfter[runIndex];
+               myTrace[runIndex].start = totalTime;
 
-           // record this log and print it out
-           recordLog( &myLog[logIndex], totalTime, logComment );
-           printLog( myLog[logIndex] );
-           logIndex ++;
+               // admit the next entering process or retire the running one
+               if( metaArray[metaIndex].component == 'A' )
+                  {
+                   if( strcmp( metaArray[metaIndex].operation, "start" ) == 0 )
+                      {
+                       processIndex = findProcess( &myProcess, PROCESS_ENTER, 
+                                                   processIndex + 1 );
+                       if( processIndex >= 0 )
+                          myProcess.state[processIndex] = PROCESS_RUNNING;
+                      }
+                   if( strcmp( metaArray[metaIndex].operation, "end" ) == 0 
+                       && processIndex >= 0 )
+                      {
+                       // every op of the process must have been charged
+                       assert( myProcess.remainingTime[processIndex] == 0 );
+                       myProcess.state[processIndex] = PROCESS_EXIT;
+                      }
+                  }
 
-           // lap timer
-           clock_gettime( CLOCK_REALTIME, &endTime );
-           totalTime = timeLap( startTime, endTime );
+               // check if the meta is a thread
+               if( isThread = checkMeta( metaArray[metaIndex], processIndex + 1, 
+                                         logComment ) )
+                  {
+                   // if it is, create a thread, unless replaying
+                   if( !isReplay )
+                      thread_create( metaArray[metaIndex], myPCB );
 
-           // check if the log needs a end log
-           if( logNeedEnd = checkLogEnd(logComment ) )
-              {
-               // if it needs, record and print
+                   // charge it to the running process
+                   if( processIndex >= 0 
+                       && myProcess.state[processIndex] == PROCESS_RUNNING )
+                      myProcess.remainingTime[processIndex] -= 
+                                        calcTime( metaArray[metaIndex], myPCB );
+                  }
+
+               // record this log and print it out
                recordLog( &myLog[logIndex], totalTime, logComment );
-               printLog( myLog[logIndex] );
+               if( run == numberOfRun - 1 )
+                  printLog( myLog[logIndex] );
                logIndex ++;
-              }
-           }   // end of loop
+
+               // lap timer, or take the recorded time when replaying
+               clock_gettime( CLOCK_REALTIME, &endTime );
+               totalTime = timeLap( startTime, endTime );
+               if( isReplay )
+                  totalTime = myTrace[runIndex].end;
+               myTrace[runIndex].end = totalTime;
+
+               // check if the log needs a end log
+               if( logNeedEnd = checkLogEnd(logComment ) )
+                  {
+                   // if it needs, record and print
+                   recordLog( &myLog[logIndex], totalTime, logComment );
+                   if( run == numberOfRun - 1 )
+                      printLog( myLog[logIndex] );
+                   logIndex ++;
+                  }
+
+               // the running process goes on at its program counter
+               if( processIndex >= 0 
+                   && myProcess.state[processIndex] == PROCESS_RUNNING )
+                  runIndex = ++ myProcess.programCounter[processIndex];
+               else
+                  runIndex ++;
+               }   // end of loop
+          }   // end of loop
 
        // output the logs to file
        outputToFile(myLog,myPCB, logIndex);
 
-       return 0;
+       // print the disk scheduling report
+       diskResponse( metaArray, runOrder, queuedAfter, myTrace, numThreads, 
+                     &myDisk );
+       printDiskReport( myDisk, myPCB );
+
+       // save the logged run, or check the median trace of the runs
+       if( isRecord )
+          writeTrace( argv[3], myTrace, numThreads );
+       if( isCompare )
+          {
+           medianTrace( runTrace, numberOfRun, numThreads, medTrace, 
+                        &myArena );
+           numberOfRegression = compareTrace( baseTrace, medTrace, numThreads, 
+                                             threshold, floorTime );
+          }
+
+       // release the per-run storage
+       arenaRelease( &myArena );
+
+       return numberOfRegression > 0 ? 1 : 0;
       }   // end of main
 
 //
@@ -157,6 +481,8 @@
 *
 * @post if the config file doesn't exist, end the program
 *
+* @post if the disk policy is unknown, end the program
+*
 * @post all pcb information recorded in pcb table
 *
 * @return None
@@ -168,6 +494,7 @@
        char line[40];   // string holds each line of file
        int charIndex = 0;   // index of string
        int stringIndex = 0;   // index to pcb string
+       bool hasSeekTime = false;   // check if the seek time was given
 
        // open file and read
        filePtr = fopen( fileName, "r" );
@@ -216,6 +543,7 @@
                                stringIndex++;
                               }
                            pcb -> dataFile[stringIndex] = '\0';
+                           break;
                           }
                       }
                   }
@@ -349,10 +677,149 @@
                                stringIndex ++;
                               }
                            pcb -> outputFile[stringIndex] = '\0';
+                           break;
+                          }
+                      }
+                  }
+
+               // read and record disk scheduling policy
+               if( strncmp( line, "Disk scheduling: ", 10 ) == 0 )
+                  {
+                   for( charIndex = 0; charIndex < sizeof( line ); charIndex ++ )
+                      {
+                       if( line[charIndex] == ':' ) 
+                          {
+                           do
+                              {
+                               charIndex ++;
+                              }
+                           while( line[charIndex] == ' ' );
+                           while( line[charIndex] != ' ' && line[charIndex] != '\n' 
+                                  && stringIndex < sizeof( pcb -> diskPolicy ) - 1 )
+                              {
+                               pcb -> diskPolicy[stringIndex] = line[charIndex];
+                               charIndex ++;
+                               stringIndex ++;
+                              }
+                           pcb -> diskPolicy[stringIndex] = '\0';
+                           break;
+                          }
+                      }
+                  }
+
+               // read and record number of disk tracks
+               if( strncmp( line, "Disk tracks: ", 10 ) == 0 )
+                  {
+                   for( charIndex = 0; charIndex < sizeof( line ); charIndex ++ )
+                      {
+                       if( line[charIndex] == ':' ) 
+                          {
+                           do
+                              {
+                               charIndex ++;
+                              }
+                           while( line[charIndex] == ' ' );
+                           while( line[charIndex] != ' ' && line[charIndex] != '\n' )
+                              {
+                               pcb -> diskTracks = pcb -> diskTracks * 10 
+                                      + line[charIndex] - '0';
+                               charIndex ++;
+                              }
+                           break;
+                          }
+                      }
+                  }
+
+               // read and record disk seek time per track
+               if( strncmp( line, "Disk seek time (msec/track): ", 10 ) == 0 )
+                  {
+                   hasSeekTime = true;
+                   for( charIndex = 0; charIndex < sizeof( line ); charIndex ++ )
+                      {
+                       if( line[charIndex] == ':' ) 
+                          {
+                           do
+                              {
+                               charIndex ++;
+                              }
+                           while( line[charIndex] == ' ' );
+                           while( line[charIndex] != ' ' && line[charIndex] != '\n' )
+                              {
+                               pcb -> diskSeekTime = pcb -> diskSeekTime * 10 
+                                      + line[charIndex] - '0';
+                               charIndex ++;
+                              }
+                           break;
+                          }
+                      }
+                  }
+
+               // read and record disk queue depth
+               if( strncmp( line, "Disk queue depth: ", 10 ) == 0 )
+                  {
+                   for( charIndex = 0; charIndex < sizeof( line ); charIndex ++ )
+                      {
+                       if( line[charIndex] == ':' ) 
+                          {
+                           do
+                              {
+                               charIndex ++;
+                              }
+                           while( line[charIndex] == ' ' );
+                           while( line[charIndex] != ' ' && line[charIndex] != '\n' )
+                              {
+                               pcb -> diskQueueDepth = pcb -> diskQueueDepth * 10 
+                                      + line[charIndex] - '0';
+                               charIndex ++;
+                              }
+                           break;
+                          }
+                      }
+                  }
+
+               // read and record disk track seed
+               if( strncmp( line, "Disk seed: ", 10 ) == 0 )
+                  {
+                   for( charIndex = 0; charIndex < sizeof( line ); charIndex ++ )
+                      {
+                       if( line[charIndex] == ':' ) 
+                          {
+                           do
+                              {
+                               charIndex ++;
+                              }
+                           while( line[charIndex] == ' ' );
+                           while( line[charIndex] != ' ' && line[charIndex] != '\n' )
+                              {
+                               pcb -> diskSeed = pcb -> diskSeed * 10 
+                                      + line[charIndex] - '0';
+                               charIndex ++;
+                              }
+                           break;
                           }
                       }
                   }
               }   // end of loop
+
+           // default the disk settings that were not given
+           if( pcb -> diskPolicy[0] == '\0' )
+              strcpy( pcb -> diskPolicy, "FCFS" );
+           if( pcb -> diskTracks <= 0 )
+              pcb -> diskTracks = 200;
+           if( pcb -> diskQueueDepth <= 0 )
+              pcb -> diskQueueDepth = 8;
+           if( !hasSeekTime )
+              pcb -> diskSeekTime = 1;
+
+           // reject a disk policy the drive doesn't know
+           if( strcmp( pcb -> diskPolicy, "FCFS" ) != 0 
+               && strcmp( pcb -> diskPolicy, "SSTF" ) != 0 
+               && strcmp( pcb -> diskPolicy, "SCAN" ) != 0 
+               && strcmp( pcb -> diskPolicy, "CLOOK" ) != 0 )
+              {
+               printf( "UNKNOWN DISK SCHEDULING POLICY!\n" );
+               exit( 1 );
+              }
           }
 
       // close file
@@ -422,9 +889,21 @@
                       metaData[stringIndex].operation[k] = line[charIndex];
                    metaData[stringIndex].operation[k] = '\0';
                    charIndex ++;
-                   for( ; line[charIndex] != ';' && line[charIndex] != '.'; charIndex ++)
+                   metaData[stringIndex].track = -1;
+                   for( ; line[charIndex] != ';' && line[charIndex] != '.' 
+                          && line[charIndex] != ':'; charIndex ++)
                    metaData[stringIndex].cyc_time = metaData[stringIndex].cyc_time * 10 
                                                     + line[charIndex] - '0';
+
+                   // read the optional track target, e.g. I(hard drive)14:120;
+                   if( line[charIndex] == ':' )
+                      {
+                       metaData[stringIndex].track = 0;
+                       for( charIndex ++; line[charIndex] != ';' 
+                            && line[charIndex] != '.'; charIndex ++ )
+                       metaData[stringIndex].track = metaData[stringIndex].track * 10 
+                                                     + line[charIndex] - '0';
+                      }
                    if( line[charIndex] == ';' )
                       stringIndex ++;
                   }   // end of loop
@@ -469,6 +948,8 @@
 *
 * @pre struct metaData contains the meta data
 *
+* @pre int processNumber contains the number of the running process
+*
 * @pre char comment contains the comment of its log
 *
 * @post the comment that needs to print and output
@@ -478,7 +959,7 @@
 * @return false if the meta is not to create a thread
 *
 */
-   bool checkMeta( struct meta metaData, char comment[40] )
+   bool checkMeta( struct meta metaData, int processNumber, char comment[40] )
       {
        char temp[40] = { 0 };   // temp string
 
@@ -493,24 +974,22 @@
        if( metaData.component == 'A' )
           {
            if( strcmp( metaData.operation, "start" ) == 0)
-              strcpy( temp, "OS: preparing process 1" );
+              snprintf( temp, sizeof( temp ), "OS: preparing process %d", 
+                        processNumber );
            if( strcmp( metaData.operation, "end" ) == 0 )
-              strcpy( temp, "OS: removing process 1" );
+              snprintf( temp, sizeof( temp ), "OS: removing process %d", 
+                        processNumber );
           }
        if( metaData.component == 'P' || metaData.component == 'I' 
            || metaData.component == 'O' )
           {
            if( metaData.component == 'P' )
-              strcpy( temp, "Process 1: start processing action" );
+              snprintf( temp, sizeof( temp ), 
+                        "Process %d: start processing action", processNumber );
            else
-              {
-               strcpy( temp, "Process 1: start " );
-               strcat( temp, metaData.operation );
-               if( metaData.component == 'I' )
-                  strcat( temp, " input" );
-               if( metaData.component == 'O' )
-                  strcat( temp, " ouput" );
-              }
+              snprintf( temp, sizeof( temp ), "Process %d: start %s %s", 
+                        processNumber, metaData.operation, 
+                        metaData.component == 'I' ? "input" : "ouput" );
           }
 
        // copy the comment
@@ -547,12 +1026,17 @@
        // for the log doesn't need an end
        if( strcmp( comment, "Simulator program starting" ) == 0 
            || strcmp( comment, "Simulator program ending" ) == 0 
-           || strcmp( comment, "OS: removing process 1" ) == 0 )
+           || strncmp( comment, "OS: removing process ", 21 ) == 0 )
           return false;
 
        // make the end for the log needs
-       else if( strcmp( comment, "OS: preparing process 1" ) == 0 )
-          strcpy( comment, "OS: starting process 1" );
+       else if( strncmp( comment, "OS: preparing process ", 22 ) == 0 )
+          {
+           char temp[40];
+           snprintf( temp, sizeof( temp ), "OS: starting %s", 
+                     comment + strlen( "OS: preparing " ) );
+           strcpy( comment, temp );
+          }
        else
           {
            stringIndex = strstr( comment, "start" );
@@ -613,7 +1097,7 @@
    int calcTime( struct meta metaData, struct pcb_table pcb )
       {
        int time = 0;   // init. time
-       char temp[10] = { 0 };   // string temp
+       char temp[11] = { 0 };   // string temp
        int numberOfCycle = 0;   // number of cycles
        strcpy( temp, metaData.operation );
        numberOfCycle = metaData.cyc_time;
@@ -623,7 +1107,8 @@
            || strcmp( temp, "end" ) == 0 )
           time = pcb.processorCycleTime * numberOfCycle;
        if( strcmp( temp, "hard drive" ) == 0 )
-          time = pcb.hardDriveCycleTime * numberOfCycle;
+          time = pcb.hardDriveCycleTime * numberOfCycle 
+                 + metaData.seekDistance * pcb.diskSeekTime;
        if( strcmp( temp, "keyboard" ) == 0 )
           time = pcb.keyboardCycleTime * numberOfCycle;
        if( strcmp( temp, "monitor" ) == 0 )
@@ -734,5 +1219,1381 @@
        fclose( filePtr );
       }   // end of func
 
+/**
+* @brief Function schedules the hard drive requests
+*
+* @details Function gives each process its own pending queue on the
+*          drive: when the process starts it queues its hard drive
+*          requests in meta data order, up to the queue depth, and one
+*          more each time a request finishes; the drive serves them with
+*          the configured policy (FCFS, SSTF, SCAN or CLOOK) and the
+*          hard drive ops of the process run in that order; the head
+*          starts at track zero moving up
+*
+* @pre struct metaData contains the meta data
+*
+* @pre int numberOfMeta contains the number of meta data
+*
+* @pre struct pcb contains the pcb table
+*
+* @pre int runOrder contains the meta data in the order they run
+*
+* @pre int queuedAfter contains, for each hard drive op in run order,
+*      the position of the op whose end queued it, -1 for time zero
+*
+* @pre struct* report contains the disk report
+*
+* @post requests without a track target get one from the seeded generator
+*
+* @post seek distance from the previous request served recorded
+*
+* @post number of requests and total seek distance recorded in report
+*
+* @return None
+*
+*/
+   void diskSchedule( struct meta metaData[], int numberOfMeta, 
+                      struct pcb_table pcb, int runOrder[], int queuedAfter[], 
+                      struct diskReport* report )
+      {
+       int* queue;   // pending request queue
+       int* arrival;   // op whose end queued each pending request
+       int depth = pcb.diskQueueDepth;   // depth of the queue
+       int numberPending = 0;   // number of pending requests
+       int nextArrival = 0;   // index to next meta data to queue
+       int lastEnd = -1;   // position of the op that queues requests
+       unsigned int seed = pcb.diskSeed;   // track generator seed
+       int head = 0;   // current track of the head
+       int direction = 1;   // head direction, 1 up and -1 down
+       int queueIndex = 0;   // index to selected request
+       int metaIndex = 0;   // index to meta data
+       int runIndex = 0;   // index to run order
+       int distance = 0;   // seek distance of selected request
+
+       report -> numberOfRequests = 0;
+       report -> totalSeek = 0;
+       report -> averageResponse = 0;
+
+       // the queue never holds more than the whole program
+       if( depth > numberOfMeta )
+          depth = numberOfMeta;
+       queue = malloc( 2 * depth * sizeof( int ) );
+       if( queue == NULL )
+          {
+           printf( "OUT OF MEMORY!\n" );
+           exit( 1 );
+          }
+       arrival = queue + depth;
+
+       // loop through the meta data array
+       for( runIndex = 0; runIndex < numberOfMeta; runIndex ++ )
+          {
+           runOrder[runIndex] = runIndex;
+           queuedAfter[runIndex] = -1;
+
+           // a process starting or ending begins a new queue
+           if( metaData[runIndex].component == 'A' )
+              {
+               nextArrival = runIndex + 1;
+               lastEnd = runIndex;
+               continue;
+              }
+           if( strcmp( metaData[runIndex].operation, "hard drive" ) != 0 )
+              continue;
+
+           // fill the pending queue up to its depth
+           while( numberPending < depth && nextArrival < numberOfMeta 
+                  && metaData[nextArrival].component != 'A' )
+              {
+               metaIndex = nextArrival;
+               nextArrival ++;
+               if( strcmp( metaData[metaIndex].operation, "hard drive" ) != 0 )
+                  continue;
+               if( metaData[metaIndex].track < 0 )
+                  metaData[metaIndex].track = nextTrack( &seed, pcb.diskTracks );
+               if( metaData[metaIndex].track >= pcb.diskTracks )
+                  {
+                   printf( "DISK TRACK OUT OF RANGE!\n" );
+                   free( queue );
+                   exit( 1 );
+                  }
+               queue[numberPending] = metaIndex;
+               arrival[numberPending] = lastEnd;
+               numberPending ++;
+              }
+
+           // run the request chosen by the policy in this slot
+           queueIndex = selectRequest( metaData, queue, numberPending, head, 
+                                       &direction, pcb, &distance );
+           metaIndex = queue[queueIndex];
+           metaData[metaIndex].seekDistance = distance;
+           runOrder[runIndex] = metaIndex;
+           queuedAfter[runIndex] = arrival[queueIndex];
+           head = metaData[metaIndex].track;
+           lastEnd = runIndex;
+           report -> numberOfRequests ++;
+           report -> totalSeek += distance;
+
+           // remove it from the queue, keeping arrival order
+           numberPending --;
+           memmove( &queue[queueIndex], &queue[queueIndex + 1], 
+                    ( numberPending - queueIndex ) * sizeof( int ) );
+           memmove( &arrival[queueIndex], &arrival[queueIndex + 1], 
+                    ( numberPending - queueIndex ) * sizeof( int ) );
+          }   // end of loop
+
+       free( queue );
+      }   // end of func
+
+/**
+* @brief Function calculates the disk response time
+*
+* @details Function takes the response time of each hard drive op from
+*          the logged run, from the end of the op that queued it to the
+*          end of the op itself
+*
+* @pre struct metaData contains the meta data
+*
+* @pre int runOrder contains the meta data in the order they ran
+*
+* @pre int queuedAfter contains the op whose end queued each request
+*
+* @pre struct trace contains the trace of the run
+*
+* @pre int numberOfTrace contains the number of traced meta data
+*
+* @pre struct* report contains the disk report
+*
+* @post average response time in msec recorded in report
+*
+* @return None
+*
+*/
+   void diskResponse( struct meta metaData[], int runOrder[], 
+                      int queuedAfter[], struct opTrace trace[], 
+                      int numberOfTrace, struct diskReport* report )
+      {
+       int runIndex = 0;   // index to run order
+       int numberOfRequests = 0;   // number of hard drive ops
+       double totalResponse = 0;   // sum of response times
+
+       for( runIndex = 0; runIndex < numberOfTrace; runIndex ++ )
+          {
+           if( strcmp( metaData[runOrder[runIndex]].operation, "hard drive" ) != 0 )
+              continue;
+           totalResponse += trace[runIndex].end 
+                            - ( queuedAfter[runIndex] >= 0 
+                                ? trace[queuedAfter[runIndex]].end : 0 );
+           numberOfRequests ++;
+          }
 
+       report -> averageResponse = 0;
+       if( numberOfRequests > 0 )
+          report -> averageResponse = totalResponse * 1000 / numberOfRequests;
+      }   // end of func
 
+/**
+* @brief Function selects the next request to service
+*
+* @details Function picks a pending request by the disk policy;
+*          SCAN sweeps to the edge of the disk before reversing and
+*          CLOOK jumps back to the lowest pending track
+*
+* @pre struct metaData contains the meta data
+*
+* @pre int queue contains the pending requests in arrival order
+*
+* @pre int numberPending contains the number of pending requests
+*
+* @pre int head contains the current track of the head
+*
+* @pre int* direction contains the head direction
+*
+* @pre struct pcb contains the pcb table
+*
+* @pre int* distance contains the seek distance
+*
+* @post head direction updated if SCAN reverses
+*
+* @post seek distance to the selected request recorded
+*
+* @return int index to the selected request in the queue
+*
+*/
+   int selectRequest( struct meta metaData[], int queue[], int numberPending, 
+                      int head, int* direction, struct pcb_table pcb, 
+                      int* distance )
+      {
+       int queueIndex = 0;   // index to queue
+       int best = -1;   // index to best request
+       int bestDistance = 0;   // distance to best request
+       int track = 0;   // track of a request
+       int edge = 0;   // distance to the edge of the disk
+
+       // shortest seek first
+       if( strcmp( pcb.diskPolicy, "SSTF" ) == 0 )
+          {
+           for( queueIndex = 0; queueIndex < numberPending; queueIndex ++ )
+              {
+               track = metaData[queue[queueIndex]].track;
+               if( best < 0 || abs( track - head ) < bestDistance )
+                  {
+                   best = queueIndex;
+                   bestDistance = abs( track - head );
+                  }
+              }
+          }
+
+       // elevator, reverse at the edge of the disk
+       else if( strcmp( pcb.diskPolicy, "SCAN" ) == 0 )
+          {
+           for( queueIndex = 0; queueIndex < numberPending; queueIndex ++ )
+              {
+               track = metaData[queue[queueIndex]].track;
+               if( ( track - head ) * *direction >= 0 
+                   && ( best < 0 || abs( track - head ) < bestDistance ) )
+                  {
+                   best = queueIndex;
+                   bestDistance = abs( track - head );
+                  }
+              }
+
+           // nothing ahead, sweep to the edge and reverse
+           if( best < 0 )
+              {
+               edge = ( *direction > 0 ) ? pcb.diskTracks - 1 - head : head;
+               head = ( *direction > 0 ) ? pcb.diskTracks - 1 : 0;
+               *direction = - *direction;
+               for( queueIndex = 0; queueIndex < numberPending; queueIndex ++ )
+                  {
+                   track = metaData[queue[queueIndex]].track;
+                   if( best < 0 || abs( track - head ) < bestDistance )
+                      {
+                       best = queueIndex;
+                       bestDistance = abs( track - head );
+                      }
+                  }
+               bestDistance += edge;
+              }
+          }
+
+       // circular look, serve upward then jump to the lowest track
+       else if( strcmp( pcb.diskPolicy, "CLOOK" ) == 0 )
+          {
+           for( queueIndex = 0; queueIndex < numberPending; queueIndex ++ )
+              {
+               track = metaData[queue[queueIndex]].track;
+               if( track >= head && ( best < 0 || track - head < bestDistance ) )
+                  {
+                   best = queueIndex;
+                   bestDistance = track - head;
+                  }
+              }
+           if( best < 0 )
+              {
+               for( queueIndex = 0; queueIndex < numberPending; queueIndex ++ )
+                  {
+                   track = metaData[queue[queueIndex]].track;
+                   if( best < 0 || track < metaData[queue[best]].track )
+                      best = queueIndex;
+                  }
+               bestDistance = head - metaData[queue[best]].track;
+              }
+          }
+
+       // first come, first served
+       else
+          {
+           best = 0;
+           bestDistance = abs( metaData[queue[0]].track - head );
+          }
+
+       *distance = bestDistance;
+       return best;
+      }   // end of func
+
+/**
+* @brief Function generates a track target
+*
+* @details Function steps a linear congruential generator so the
+*          same seed always gives the same tracks
+*
+* @pre unsigned int* seed contains the generator state
+*
+* @pre int numberOfTracks contains the number of tracks on the disk
+*
+* @post generator state advanced
+*
+* @return int track in range of the disk
+*
+*/
+   int nextTrack( unsigned int* seed, int numberOfTracks )
+      {
+       *seed = *seed * 1103515245 + 12345;
+       return ( *seed >> 16 ) % numberOfTracks;
+      }   // end of func
+
+/**
+* @brief Function prints the disk report
+*
+* @details Function prints the disk scheduling results to screen
+*
+* @pre struct report contains the disk report
+*
+* @pre struct pcb contains the pcb table
+*
+* @post the report printed on screen
+*
+* @return None
+*
+*/
+   void printDiskReport( struct diskReport report, struct pcb_table pcb )
+      {
+       if( report.numberOfRequests == 0 )
+          return;
+       printf( "Disk scheduling (%s): %d requests, total seek %d tracks, "
+               "average response %.2f msec\n", pcb.diskPolicy, 
+               report.numberOfRequests, report.totalSeek, report.averageResponse );
+      }   // end of func
+
+/**
+* @brief Function counts the meta data
+*
+* @details Function counts the meta data and the processes in the
+*          data file so their storage can be sized before reading
+*
+* @pre char* fileName contains the name of data file
+*
+* @pre int* numberOfMeta contains the number of meta data
+*
+* @pre int* numberOfProcess contains the number of processes
+*
+* @post if the data file doesn't exist, end the program
+*
+* @post upper bound of meta data and number of processes recorded
+*
+* @return None
+*
+*/
+   void countMeta( char* fileName, int* numberOfMeta, int* numberOfProcess )
+      {
+       FILE* filePtr;   // file pointer
+       char line[100];   // string holds each line of file
+       char* position;   // position inside the line
+       int charIndex = 0;   // index to string
+
+       *numberOfMeta = 1;
+       *numberOfProcess = 0;
+
+       // open file
+       filePtr = fopen( fileName, "r" );
+
+       // if the file doesn't exist
+       if( filePtr == NULL )
+          {
+           printf( "META DATA FILE NOT FOUND!\n" );
+           exit( 1 );
+          }
+
+       // loop to get each line
+       while( fgets( line, sizeof( line ), filePtr ) )
+          {
+           // ignore these lines
+           if( strncmp( line, "Start Program Meta-Data Code:", 15 ) == 0 ) 
+              continue;
+           if( strncmp( line, "End Program Meta-Data Code.", 15 ) == 0 ) 
+              continue;
+
+           // each meta data ends with ';' or '.'
+           for( charIndex = 0; line[charIndex] != '\0'; charIndex ++ )
+              if( line[charIndex] == ';' || line[charIndex] == '.' )
+                 ( *numberOfMeta ) ++;
+
+           // each process begins with A(start)
+           for( position = strstr( line, "A(start)" ); position != NULL; 
+                position = strstr( position + 1, "A(start)" ) )
+              ( *numberOfProcess ) ++;
+          }   // end of loop
+
+       // close file
+       fclose( filePtr );
+      }   // end of func
+
+/**
+* @brief Function initializes an arena
+*
+* @details Function reserves the first zeroed block that later
+*          allocations bump through, so the whole run is released at once
+*
+* @pre struct* pool contains the arena
+*
+* @pre size_t size contains the number of bytes to reserve
+*
+* @post if the block can't be reserved, end the program
+*
+* @return None
+*
+*/
+   void arenaInit( struct arena* pool, size_t size )
+      {
+       pool -> base = NULL;
+       pool -> size = 0;
+       pool -> used = 0;
+       arenaBlock( pool, size );
+      }   // end of func
+
+/**
+* @brief Function adds a block to an arena
+*
+* @details Function reserves a zeroed block at least as large as the
+*          one before and chains it in front of the arena
+*
+* @pre struct* pool contains the arena
+*
+* @pre size_t size contains the number of bytes needed
+*
+* @post if the block can't be reserved, end the program
+*
+* @return None
+*
+*/
+   void arenaBlock( struct arena* pool, size_t size )
+      {
+       char* block;   // new block
+
+       size += ARENA_ALIGN;
+       if( size < pool -> size )
+          size = pool -> size;
+       block = calloc( size, 1 );
+       if( block == NULL )
+          {
+           printf( "OUT OF MEMORY!\n" );
+           exit( 1 );
+          }
+       *( char** )block = pool -> base;
+       pool -> base = block;
+       pool -> size = size;
+       pool -> used = ARENA_ALIGN;
+      }   // end of func
+
+/**
+* @brief Function allocates from an arena
+*
+* @details Function bumps the arena by the aligned size, chaining a new
+*          block when the current one is full
+*
+* @pre struct* pool contains the arena
+*
+* @pre size_t size contains the number of bytes wanted
+*
+* @post if no block can be reserved, end the program
+*
+* @return void* zeroed memory inside the arena
+*
+*/
+   void* arenaAlloc( struct arena* pool, size_t size )
+      {
+       void* block;   // allocated block
+
+       size = ( size + ARENA_ALIGN - 1 ) & ~( size_t )( ARENA_ALIGN - 1 );
+       if( pool -> used + size > pool -> size )
+          arenaBlock( pool, size );
+       block = pool -> base + pool -> used;
+       pool -> used += size;
+       return block;
+      }   // end of func
+
+/**
+* @brief Function releases an arena
+*
+* @details Function frees every block of the arena at once
+*
+* @pre struct* pool contains the arena
+*
+* @post the arena is empty
+*
+* @return None
+*
+*/
+   void arenaRelease( struct arena* pool )
+      {
+       char* block;   // block before the current one
+
+       while( pool -> base != NULL )
+          {
+           block = *( char** )pool -> base;
+           free( pool -> base );
+           pool -> base = block;
+          }
+       pool -> size = 0;
+       pool -> used = 0;
+      }   // end of func
+
+/**
+* @brief Function builds the process table
+*
+* @details Function allocates one array per field from the arena and
+*          loads the processes into it
+*
+* @pre struct* table contains the process table
+*
+* @pre struct* pool contains the arena
+*
+* @pre struct metaData contains the meta data
+*
+* @pre int runOrder contains the meta data in the order they run
+*
+* @pre int numberOfMeta contains the number of meta data
+*
+* @pre int numberOfProcess contains the number of processes
+*
+* @pre struct pcb contains the pcb table
+*
+* @post every process entered with its start and remaining time
+*
+* @return None
+*
+*/
+   void processInit( struct process_table* table, struct arena* pool, 
+                     struct meta metaData[], int runOrder[], int numberOfMeta, 
+                     int numberOfProcess, struct pcb_table pcb )
+      {
+       table -> numberOfProcess = numberOfProcess;
+       table -> state = arenaAlloc( pool, numberOfProcess * sizeof( unsigned char ) );
+       table -> remainingTime = arenaAlloc( pool, numberOfProcess * sizeof( int ) );
+       table -> programCounter = arenaAlloc( pool, numberOfProcess * sizeof( int ) );
+
+       processLoad( table, metaData, runOrder, numberOfMeta, pcb );
+      }   // end of func
+
+/**
+* @brief Function loads the process table
+*
+* @details Function records where each process starts and how long
+*          it will run, so the table can be loaded again for each run
+*
+* @pre struct* table contains the process table
+*
+* @pre struct metaData contains the meta data
+*
+* @pre int runOrder contains the meta data in the order they run
+*
+* @pre int numberOfMeta contains the number of meta data
+*
+* @pre struct pcb contains the pcb table
+*
+* @post every process entered with its start and remaining time
+*
+* @return None
+*
+*/
+   void processLoad( struct process_table* table, struct meta metaData[], 
+                     int runOrder[], int numberOfMeta, struct pcb_table pcb )
+      {
+       int runIndex = 0;   // index to run order
+       int metaIndex = 0;   // index to meta data
+       int processIndex = -1;   // index to process
+       bool isOpen = false;   // check if the process has not ended
+
+       // loop through the meta data in the order they run
+       for( runIndex = 0; runIndex < numberOfMeta; runIndex ++ )
+          {
+           metaIndex = runOrder[runIndex];
+           if( metaData[metaIndex].component == 'A' 
+               && strcmp( metaData[metaIndex].operation, "start" ) == 0 
+               && processIndex + 1 < table -> numberOfProcess )
+              {
+               processIndex ++;
+               isOpen = true;
+               table -> state[processIndex] = PROCESS_ENTER;
+               table -> remainingTime[processIndex] = 0;
+               table -> programCounter[processIndex] = runIndex;
+              }
+           else if( metaData[metaIndex].component == 'A' 
+                    && strcmp( metaData[metaIndex].operation, "end" ) == 0 )
+              isOpen = false;
+           else if( isOpen && ( metaData[metaIndex].component == 'P' 
+                    || metaData[metaIndex].component == 'I' 
+                    || metaData[metaIndex].component == 'O' ) )
+              table -> remainingTime[processIndex] += 
+                                    calcTime( metaData[metaIndex], pcb );
+          }   // end of loop
+      }   // end of func
+
+/**
+* @brief Function finds a process by state
+*
+* @details Function scans only the state array for the first process
+*          in the given state
+*
+* @pre struct* table contains the process table
+*
+* @pre unsigned char state contains the state to find
+*
+* @pre int from contains the index to start from
+*
+* @post None
+*
+* @return int index to the process, -1 if none
+*
+*/
+   int findProcess( struct process_table* table, unsigned char state, 
+                    int from )
+      {
+       int processIndex = 0;   // index to process
+
+       for( processIndex = from; processIndex < table -> numberOfProcess; 
+            processIndex ++ )
+          if( table -> state[processIndex] == state )
+             return processIndex;
+       return -1;
+      }   // end of func
+
+/**
+* @brief Function reads the sweep grid
+*
+* @details Function reads the cycle times to sweep for each device,
+*          written like the config file with several values per line,
+*          e.g. Printer cycle time (msec): 250 500 1000
+*
+* @pre char* fileName contains the name of grid file
+*
+* @pre struct* grid contains the sweep grid
+*
+* @pre struct pcb contains the pcb table
+*
+* @post if the grid file doesn't exist, end the program
+*
+* @post if a line is not a device key or a Start/End Sweep Grid marker,
+*       has a bad or negative value, or more than SWEEP_MAX_VALUES
+*       values, end the program
+*
+* @post devices not in the grid keep their config cycle time
+*
+* @return None
+*
+*/
+   void readSweep( char* fileName, struct sweep_grid* grid, 
+                   struct pcb_table pcb )
+      {
+       FILE* filePtr;   // file pointer
+       char line[100];   // string holds each line of file
+       char* position;   // position inside the line
+       char* next;   // position after a value
+       int device = 0;   // index to device
+       long value = 0;   // value read
+
+       memset( grid, 0, sizeof( struct sweep_grid ) );
+
+       // open file and read
+       filePtr = fopen( fileName, "r" );
+
+       // if the file doesn't exist
+       if( filePtr == NULL )
+          {
+           printf( "SWEEP FILE NOT FOUND!\n" );
+           exit( 1 );
+          }
+
+       // loop to each line
+       while( fgets( line, sizeof( line ), filePtr ) )
+          {
+           // ignore these lines
+           if( strncmp( line, "Start Sweep Grid", 16 ) == 0 )
+              continue;
+           if( strncmp( line, "End Sweep Grid", 14 ) == 0 )
+              continue;
+           if( line[strspn( line, " \t\r\n" )] == '\0' )
+              continue;
+
+           // find the device of this line, the whole key must match
+           if( strncmp( line, "Processor cycle time (msec):", 28 ) == 0 )
+              device = 0;
+           else if( strncmp( line, "Monitor display time (msec):", 28 ) == 0 )
+              device = 1;
+           else if( strncmp( line, "Hard drive cycle time (msec):", 29 ) == 0 )
+              device = 2;
+           else if( strncmp( line, "Printer cycle time (msec):", 26 ) == 0 )
+              device = 3;
+           else if( strncmp( line, "Keyboard cycle time (msec):", 27 ) == 0 )
+              device = 4;
+           else
+              {
+               printf( "INVALID SWEEP FILE!\n" );
+               exit( 1 );
+              }
+
+           // read each value after the ':'
+           position = strchr( line, ':' );
+           if( position == NULL )
+              {
+               printf( "INVALID SWEEP FILE!\n" );
+               exit( 1 );
+              }
+           position ++;
+           while( true )
+              {
+               value = strtol( position, &next, 10 );
+               if( next == position )
+                  break;
+               if( value < 0 || value > INT_MAX )
+                  {
+                   printf( "INVALID SWEEP VALUE!\n" );
+                   exit( 1 );
+                  }
+               if( grid -> numberOfValues[device] == SWEEP_MAX_VALUES )
+                  {
+                   printf( "TOO MANY SWEEP VALUES!\n" );
+                   exit( 1 );
+                  }
+               grid -> values[device][grid -> numberOfValues[device]] = value;
+               grid -> numberOfValues[device] ++;
+               position = next;
+              }
+
+           // nothing but spaces may follow the values
+           while( *position == ' ' || *position == '\t' || *position == '\r' 
+                  || *position == '\n' )
+              position ++;
+           if( *position != '\0' )
+              {
+               printf( "INVALID SWEEP VALUE!\n" );
+               exit( 1 );
+              }
+          }   // end of loop
+
+       // close file
+       fclose( filePtr );
+
+       // keep the config value for devices not swept
+       if( grid -> numberOfValues[0] == 0 )
+          grid -> values[0][grid -> numberOfValues[0] ++] = pcb.processorCycleTime;
+       if( grid -> numberOfValues[1] == 0 )
+          grid -> values[1][grid -> numberOfValues[1] ++] = pcb.monitorCycleTime;
+       if( grid -> numberOfValues[2] == 0 )
+          grid -> values[2][grid -> numberOfValues[2] ++] = pcb.hardDriveCycleTime;
+       if( grid -> numberOfValues[3] == 0 )
+          grid -> values[3][grid -> numberOfValues[3] ++] = pcb.printerCycleTime;
+       if( grid -> numberOfValues[4] == 0 )
+          grid -> values[4][grid -> numberOfValues[4] ++] = pcb.keyboardCycleTime;
+      }   // end of func
+
+/**
+* @brief Function runs the parameter sweep
+*
+* @details Function totals the cycles of the parsed program per device
+*          once, lays out every combination of the grid one array per
+*          device, and splits the combinations across threads that
+*          evaluate them in virtual time
+*
+* @pre struct metaData contains the meta data
+*
+* @pre int numberOfMeta contains the number of meta data
+*
+* @pre struct pcb contains the pcb table
+*
+* @pre struct report contains the disk report
+*
+* @pre struct grid contains the sweep grid
+*
+* @post table of total runtime and busy time per device printed
+*
+* @return None
+*
+*/
+   void runSweep( struct meta metaData[], int numberOfMeta, 
+                  struct pcb_table pcb, struct diskReport report, 
+                  struct sweep_grid grid )
+      {
+       struct arena sweepArena = { 0, 0, 0 };   // arena for the sweep
+       struct sweep_batch batch[SWEEP_MAX_THREADS];   // slice per thread
+       pthread_t thread[SWEEP_MAX_THREADS];   // worker threads
+       bool isStarted[SWEEP_MAX_THREADS];   // check if the thread started
+       int numberOfConfig = 1;   // number of configurations
+       int numberOfThread = 1;   // number of threads
+       int config = 0;   // index to configuration
+       int rest = 0;   // remaining digits of the configuration
+       int device = 0;   // index to device
+       int metaIndex = 0;   // index to meta data
+       int threadIndex = 0;   // index to thread
+
+       for( device = 0; device < NUMBER_OF_DEVICES; device ++ )
+          numberOfConfig *= grid.numberOfValues[device];
+
+       arenaInit( &sweepArena, ( 2 * NUMBER_OF_DEVICES + 1 ) 
+                  * ( numberOfConfig * sizeof( double ) + ARENA_ALIGN ) );
+
+       // total the cycles of the program per device
+       memset( &batch[0], 0, sizeof( struct sweep_batch ) );
+       for( metaIndex = 0; metaIndex < numberOfMeta; metaIndex ++ )
+          if( ( device = deviceOf( metaData[metaIndex] ) ) >= 0 )
+             batch[0].cycles[device] += metaData[metaIndex].cyc_time;
+       batch[0].seekTime = ( double )report.totalSeek * pcb.diskSeekTime;
+
+       // lay out the cycle time of every configuration
+       for( device = 0; device < NUMBER_OF_DEVICES; device ++ )
+          {
+           batch[0].cycleTime[device] = arenaAlloc( &sweepArena, 
+                                        numberOfConfig * sizeof( double ) );
+           batch[0].busyTime[device] = arenaAlloc( &sweepArena, 
+                                       numberOfConfig * sizeof( double ) );
+          }
+       batch[0].totalTime = arenaAlloc( &sweepArena, 
+                                        numberOfConfig * sizeof( double ) );
+       for( config = 0; config < numberOfConfig; config ++ )
+          {
+           rest = config;
+           for( device = NUMBER_OF_DEVICES - 1; device >= 0; device -- )
+              {
+               batch[0].cycleTime[device][config] = 
+                      grid.values[device][rest % grid.numberOfValues[device]];
+               rest /= grid.numberOfValues[device];
+              }
+          }
+
+       // split the configurations across the threads
+       numberOfThread = sysconf( _SC_NPROCESSORS_ONLN );
+       if( numberOfThread > SWEEP_MAX_THREADS )
+          numberOfThread = SWEEP_MAX_THREADS;
+       if( numberOfThread > numberOfConfig )
+          numberOfThread = numberOfConfig;
+       if( numberOfThread < 1 )
+          numberOfThread = 1;
+       for( threadIndex = 0; threadIndex < numberOfThread; threadIndex ++ )
+          {
+           batch[threadIndex] = batch[0];
+           batch[threadIndex].first = 
+                  ( long )numberOfConfig * threadIndex / numberOfThread;
+           batch[threadIndex].last = 
+                  ( long )numberOfConfig * ( threadIndex + 1 ) / numberOfThread;
+          }
+       for( threadIndex = 1; threadIndex < numberOfThread; threadIndex ++ )
+          {
+           isStarted[threadIndex] = pthread_create( &thread[threadIndex], 
+                                    NULL, sweepWorker, &batch[threadIndex] ) == 0;
+
+           // if the thread can't start, evaluate its slice here
+           if( !isStarted[threadIndex] )
+              sweepWorker( &batch[threadIndex] );
+          }
+       sweepWorker( &batch[0] );
+       for( threadIndex = 1; threadIndex < numberOfThread; threadIndex ++ )
+          if( isStarted[threadIndex] )
+             pthread_join( thread[threadIndex], NULL );
+
+       // print the table
+       printf( "%-8s %9s %9s %9s %9s %9s %12s %12s %12s %12s %12s %12s\n", 
+               "Config", "Proc", "Monitor", "HardDrive", "Printer", "Keyboard", 
+               "Total", "ProcBusy", "MonBusy", "DiskBusy", "PrintBusy", 
+               "KeyBusy" );
+       for( config = 0; config < numberOfConfig; config ++ )
+          {
+           printf( "%-8d", config + 1 );
+           for( device = 0; device < NUMBER_OF_DEVICES; device ++ )
+              printf( " %9.0f", batch[0].cycleTime[device][config] );
+           printf( " %12.0f", batch[0].totalTime[config] );
+           for( device = 0; device < NUMBER_OF_DEVICES; device ++ )
+              printf( " %12.0f", batch[0].busyTime[device][config] );
+           printf( "\n" );
+          }   // end of loop
+
+       // release the sweep storage
+       arenaRelease( &sweepArena );
+      }   // end of func
+
+/**
+* @brief Function evaluates a slice of the sweep
+*
+* @details Function computes the busy time of each device as its cycle
+*          total times the cycle time, one device at a time over
+*          its array of configurations, then sums them
+*
+* @pre void* batch contains the slice of configurations
+*
+* @post busy and total time of each configuration in the slice recorded
+*
+* @return None
+*
+*/
+   void* sweepWorker( void* batch )
+      {
+       struct sweep_batch* slice = batch;   // slice of configurations
+       int config = 0;   // index to configuration
+       int device = 0;   // index to device
+       double cycles = 0;   // cycle total of a device
+       double* cycleTime;   // cycle times of a device
+       double* busyTime;   // busy times of a device
+       double* totalTime = slice -> totalTime;   // total times
+
+       for( device = 0; device < NUMBER_OF_DEVICES; device ++ )
+          {
+           cycles = slice -> cycles[device];
+           cycleTime = slice -> cycleTime[device];
+           busyTime = slice -> busyTime[device];
+           for( config = slice -> first; config < slice -> last; config ++ )
+              busyTime[config] = cycles * cycleTime[config];
+          }
+
+       // the seek time doesn't depend on the cycle times
+       busyTime = slice -> busyTime[2];
+       for( config = slice -> first; config < slice -> last; config ++ )
+          busyTime[config] += slice -> seekTime;
+
+       for( config = slice -> first; config < slice -> last; config ++ )
+          totalTime[config] = slice -> busyTime[0][config] 
+                              + slice -> busyTime[1][config] 
+                              + slice -> busyTime[2][config] 
+                              + slice -> busyTime[3][config] 
+                              + slice -> busyTime[4][config];
+       return NULL;
+      }   // end of func
+
+/**
+* @brief Function finds the device of the meta
+*
+* @details Function maps the operation of the meta to its device
+*          the same way calcTime() does
+*
+* @pre struct metaData contains the meta data
+*
+* @post None
+*
+* @return int index to device, -1 if the meta runs on none
+*
+*/
+   int deviceOf( struct meta metaData )
+      {
+       if( metaData.component != 'P' && metaData.component != 'I' 
+           && metaData.component != 'O' )
+          return -1;
+       if( strcmp( metaData.operation, "run" ) == 0 )
+          return 0;
+       if( strcmp( metaData.operation, "monitor" ) == 0 )
+          return 1;
+       if( strcmp( metaData.operation, "hard drive" ) == 0 )
+          return 2;
+       if( strcmp( metaData.operation, "printer" ) == 0 )
+          return 3;
+       if( strcmp( metaData.operation, "keyboard" ) == 0 )
+          return 4;
+       return -1;
+      }   // end of func
+
+/**
+* @brief Function writes the trace
+*
+* @details Function saves the order the meta data ran in, the track,
+*          seek distance and queueing op the disk schedule gave each
+*          hard drive op, and the observed start and end time of each op
+*
+* @pre char* fileName contains the name of trace file
+*
+* @pre struct trace contains the trace of the run
+*
+* @pre int numberOfTrace contains the number of traced meta data
+*
+* @post if the trace file can't be opened, end the program
+*
+* @post trace written to file
+*
+* @return None
+*
+*/
+   void writeTrace( char* fileName, struct opTrace trace[], int numberOfTrace )
+      {
+       FILE* filePtr;   // file pointer
+       int index = 0;   // index to trace
+
+       // open file and write
+       filePtr = fopen( fileName, "w" );
+       if( filePtr == NULL )
+          {
+           printf( "TRACE FILE NOT WRITABLE!\n" );
+           exit( 1 );
+          }
+
+       fprintf( filePtr, "Start Simulator Trace\n" );
+       fprintf( filePtr, "Meta count: %d\n", numberOfTrace );
+       for( index = 0; index < numberOfTrace; index ++ )
+          fprintf( filePtr, "%d %c %d %d %d %.9f %.9f\n", trace[index].metaIndex, 
+                   trace[index].component, trace[index].track, 
+                   trace[index].seekDistance, trace[index].queuedAfter, 
+                   trace[index].start, trace[index].end );
+       fprintf( filePtr, "End Simulator Trace\n" );
+
+       // close file
+       fclose( filePtr );
+      }   // end of func
+
+/**
+* @brief Function reads the trace
+*
+* @details Function reads a recorded trace and checks that each op
+*          names a meta data of the same program
+*
+* @pre char* fileName contains the name of trace file
+*
+* @pre struct trace contains the trace to fill
+*
+* @pre int numberOfTrace contains the number of meta data
+*
+* @pre struct metaData contains the meta data
+*
+* @post if the trace file doesn't exist or doesn't match, end the program
+*
+* @post recorded decisions and timings in trace
+*
+* @return None
+*
+*/
+   void readTrace( char* fileName, struct opTrace trace[], int numberOfTrace, 
+                   struct meta metaData[] )
+      {
+       FILE* filePtr;   // file pointer
+       char line[100];   // string holds each line of file
+       int count = -1;   // number of meta data in the trace
+       int index = 0;   // index to trace
+       struct opTrace entry;   // trace line read
+
+       // open file
+       filePtr = fopen( fileName, "r" );
+
+       // if the file doesn't exist
+       if( filePtr == NULL )
+          {
+           printf( "TRACE FILE NOT FOUND!\n" );
+           exit( 1 );
+          }
+
+       // loop to each line
+       while( fgets( line, sizeof( line ), filePtr ) )
+          {
+           // ignore these lines
+           if( strncmp( line, "Start Simulator Trace", 15 ) == 0 )
+              continue;
+           if( strncmp( line, "End Simulator Trace", 15 ) == 0 )
+              continue;
+
+           if( strncmp( line, "Meta count: ", 10 ) == 0 )
+              {
+               count = atoi( line + strlen( "Meta count: " ) );
+               continue;
+              }
+
+           // each op must be a meta data of the program
+           if( sscanf( line, "%d %c %d %d %d %lf %lf", &entry.metaIndex, 
+                       &entry.component, &entry.track, &entry.seekDistance, 
+                       &entry.queuedAfter, &entry.start, &entry.end ) != 7 
+               || index >= numberOfTrace || entry.metaIndex < 0 
+               || entry.metaIndex >= numberOfTrace 
+               || entry.component != metaData[entry.metaIndex].component )
+              {
+               printf( "TRACE DOES NOT MATCH PROGRAM!\n" );
+               exit( TRACE_MISMATCH );
+              }
+           trace[index] = entry;
+           index ++;
+          }   // end of loop
+
+       // close file
+       fclose( filePtr );
+
+       if( count != numberOfTrace || index != numberOfTrace )
+          {
+           printf( "TRACE DOES NOT MATCH PROGRAM!\n" );
+           exit( TRACE_MISMATCH );
+          }
+      }   // end of func
+
+/**
+* @brief Function takes the schedule from a trace
+*
+* @details Function replays the recorded disk decisions instead of
+*          scheduling again: each hard drive slot runs the recorded
+*          request at its recorded track and seek distance, and every
+*          other op keeps its place in the program
+*
+* @pre struct trace contains the recorded trace
+*
+* @pre int numberOfTrace contains the number of meta data
+*
+* @pre struct metaData contains the meta data
+*
+* @pre struct pcb contains the pcb table
+*
+* @pre int runOrder contains the meta data in the order they run
+*
+* @pre int queuedAfter contains the op whose end queued each request
+*
+* @pre struct* report contains the disk report
+*
+* @post if the trace doesn't fit the program, end the program
+*
+* @post run order, tracks and seek distances taken from the trace
+*
+* @return None
+*
+*/
+   void traceSchedule( struct opTrace trace[], int numberOfTrace, 
+                       struct meta metaData[], struct pcb_table pcb, 
+                       int runOrder[], int queuedAfter[], 
+                       struct diskReport* report )
+      {
+       int runIndex = 0;   // index to run order
+       int metaIndex = 0;   // index to meta data
+       bool isDisk = false;   // check if the slot is a hard drive op
+
+       report -> numberOfRequests = 0;
+       report -> totalSeek = 0;
+       report -> averageResponse = 0;
+
+       // mark every hard drive request as not yet run
+       for( metaIndex = 0; metaIndex < numberOfTrace; metaIndex ++ )
+          metaData[metaIndex].seekDistance = -1;
+
+       for( runIndex = 0; runIndex < numberOfTrace; runIndex ++ )
+          {
+           metaIndex = trace[runIndex].metaIndex;
+           isDisk = strcmp( metaData[runIndex].operation, "hard drive" ) == 0;
+
+           // other ops keep their place, hard drive slots run each
+           // hard drive request once, on its given track if it has one
+           if( isDisk != ( strcmp( metaData[metaIndex].operation, 
+                                   "hard drive" ) == 0 ) 
+               || ( !isDisk && metaIndex != runIndex ) 
+               || ( isDisk && ( metaData[metaIndex].seekDistance >= 0 
+                    || trace[runIndex].track < 0 
+                    || trace[runIndex].track >= pcb.diskTracks 
+                    || trace[runIndex].seekDistance < 0 
+                    || trace[runIndex].queuedAfter >= runIndex 
+                    || trace[runIndex].queuedAfter < -1 
+                    || ( metaData[metaIndex].track >= 0 
+                         && metaData[metaIndex].track != trace[runIndex].track ) ) ) )
+              {
+               printf( "TRACE DOES NOT MATCH PROGRAM!\n" );
+               exit( TRACE_MISMATCH );
+              }
+
+           runOrder[runIndex] = metaIndex;
+           queuedAfter[runIndex] = -1;
+           if( isDisk )
+              {
+               metaData[metaIndex].track = trace[runIndex].track;
+               metaData[metaIndex].seekDistance = trace[runIndex].seekDistance;
+               queuedAfter[runIndex] = trace[runIndex].queuedAfter;
+               report -> numberOfRequests ++;
+               report -> totalSeek += trace[runIndex].seekDistance;
+              }
+          }   // end of loop
+
+       // ops that never reach the drive have no seek
+       for( metaIndex = 0; metaIndex < numberOfTrace; metaIndex ++ )
+          if( metaData[metaIndex].seekDistance < 0 )
+             metaData[metaIndex].seekDistance = 0;
+      }   // end of func
+
+/**
+* @brief Function takes the median of several runs
+*
+* @details Function takes, for each op, the median duration (end -
+*          start) and median overhead (start - end of the op before)
+*          over the runs and lays them end to end, so one slow run
+*          doesn't move the result
+*
+* @pre struct runTrace contains the trace of each run, one after another
+*
+* @pre int numberOfRun contains the number of runs
+*
+* @pre int numberOfTrace contains the number of traced meta data
+*
+* @pre struct trace contains the median trace
+*
+* @pre struct* pool contains the arena for the per-op scratch
+*
+* @post median trace recorded, with the decisions of the first run
+*
+* @return None
+*
+*/
+   void medianTrace( struct opTrace runTrace[], int numberOfRun, 
+                     int numberOfTrace, struct opTrace trace[], 
+                     struct arena* pool )
+      {
+       double* duration;   // duration of an op in each run
+       double* overhead;   // overhead of an op in each run
+       struct opTrace* runOp;   // op in one run
+       int index = 0;   // index to trace
+       int run = 0;   // index to run
+       double clock = 0;   // end of the op before
+
+       duration = arenaAlloc( pool, ( size_t )numberOfRun * sizeof( double ) );
+       overhead = arenaAlloc( pool, ( size_t )numberOfRun * sizeof( double ) );
+
+       for( index = 0; index < numberOfTrace; index ++ )
+          {
+           for( run = 0; run < numberOfRun; run ++ )
+              {
+               runOp = &runTrace[( size_t )run * numberOfTrace + index];
+               duration[run] = runOp -> end - runOp -> start;
+               overhead[run] = runOp -> start - ( index > 0 ? ( runOp - 1 ) -> end : 0 );
+              }
+           trace[index] = runTrace[index];
+           trace[index].start = clock + median( overhead, numberOfRun );
+           trace[index].end = trace[index].start + median( duration, numberOfRun );
+           clock = trace[index].end;
+          }   // end of loop
+      }   // end of func
+
+/**
+* @brief Function finds the median
+*
+* @details Function sorts the values in place and takes the middle one,
+*          or the mean of the middle two
+*
+* @pre double values contains the values
+*
+* @pre int numberOfValues contains the number of values
+*
+* @post values sorted
+*
+* @return double the median
+*
+*/
+   double median( double values[], int numberOfValues )
+      {
+       int index_1, index_2;   // indexes
+       double temp;   // value being placed
+
+       // insertion sort, the runs are few
+       for( index_1 = 1; index_1 < numberOfValues; index_1 ++ )
+          {
+           temp = values[index_1];
+           for( index_2 = index_1; index_2 > 0 && values[index_2 - 1] > temp; 
+                index_2 -- )
+              values[index_2] = values[index_2 - 1];
+           values[index_2] = temp;
+          }
+
+       if( numberOfValues % 2 == 1 )
+          return values[numberOfValues / 2];
+       return ( values[numberOfValues / 2 - 1] + values[numberOfValues / 2] ) / 2;
+      }   // end of func
+
+/**
+* @brief Function compares the trace to a baseline
+*
+* @details Function flags each op whose duration (end - start) or
+*          overhead (start - end of the op before) grew by more than
+*          both the threshold percent of the baseline and the floor,
+*          and does the same for the whole run
+*
+* @pre struct baseline contains the recorded baseline
+*
+* @pre struct trace contains the trace of this run
+*
+* @pre int numberOfTrace contains the number of traced meta data
+*
+* @pre double threshold contains the allowed growth in percent
+*
+* @pre double floorTime contains the growth in msec taken as noise
+*
+* @post if the decisions differ, end the program with TRACE_MISMATCH
+*
+* @post each regressed op printed on screen
+*
+* @return int number of regressions
+*
+*/
+   int compareTrace( struct opTrace baseline[], struct opTrace trace[], 
+                     int numberOfTrace, double threshold, double floorTime )
+      {
+       int index = 0;   // index to trace
+       int numberOfRegression = 0;   // number of regressions
+       double baseDuration, newDuration;   // durations of an op
+       double baseOverhead, newOverhead;   // overheads of an op
+       double allowed;   // growth allowed for an op
+
+       for( index = 0; index < numberOfTrace; index ++ )
+          {
+           // both runs must have made the same decisions
+           if( baseline[index].metaIndex != trace[index].metaIndex 
+               || baseline[index].track != trace[index].track )
+              {
+               printf( "TRACE DOES NOT MATCH PROGRAM!\n" );
+               exit( TRACE_MISMATCH );
+              }
+
+           baseDuration = baseline[index].end - baseline[index].start;
+           newDuration = trace[index].end - trace[index].start;
+           baseOverhead = baseline[index].start 
+                          - ( index > 0 ? baseline[index - 1].end : 0 );
+           newOverhead = trace[index].start 
+                         - ( index > 0 ? trace[index - 1].end : 0 );
+
+           allowed = baseDuration * threshold / 100;
+           if( allowed < floorTime / 1000 )
+              allowed = floorTime / 1000;
+           if( newDuration - baseDuration > allowed )
+              {
+               printf( "REGRESSION: op %d duration %f -> %f\n", index, 
+                       baseDuration, newDuration );
+               numberOfRegression ++;
+              }
+
+           allowed = baseOverhead * threshold / 100;
+           if( allowed < floorTime / 1000 )
+              allowed = floorTime / 1000;
+           if( newOverhead - baseOverhead > allowed )
+              {
+               printf( "REGRESSION: op %d overhead %f -> %f\n", index, 
+                       baseOverhead, newOverhead );
+               numberOfRegression ++;
+              }
+          }   // end of loop
+
+       // the whole run
+       if( numberOfTrace > 0 )
+          {
+           baseDuration = baseline[numberOfTrace - 1].end;
+           newDuration = trace[numberOfTrace - 1].end;
+           allowed = baseDuration * threshold / 100;
+           if( allowed < floorTime / 1000 )
+              allowed = floorTime / 1000;
+           if( newDuration - baseDuration > allowed )
+              {
+               printf( "REGRESSION: run %f -> %f\n", baseDuration, newDuration );
+               numberOfRegression ++;
+              }
+          }
+
+       printf( "Compared %d ops, %d regressions over %.1f%% and %.1f msec\n", 
+               numberOfTrace, numberOfRegression, threshold, floorTime );
+       return numberOfRegression;
+      }   // end of func
+
+/**
+* @brief Function reads a number from the command line
+*
+* @details Function reads a non-negative decimal number
+*
+* @pre char* text contains the text to read
+*
+* @pre double* value contains the number read
+*
+* @post number recorded if the text is valid
+*
+* @return true if the text is a non-negative number
+*
+*/
+   bool readNumber( char* text, double* value )
+      {
+       char* next;   // position after the number
+       double number;   // number read
+
+       number = strtod( text, &next );
+       if( next == text || *next != '\0' || !( number >= 0 ) 
+           || number > 1E9 )
+          return false;
+       *value = number;
+       return true;
+      }   // end of func